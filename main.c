@@ -548,6 +548,32 @@ static void change_seat(Passenger *head) {
     printf("Silla actualizada correctamente.\n");
 }
 
+static void write_boarding_pass(FILE *out, const Passenger *passenger) {
+    char flightDate[16];
+    char departureTime[8];
+    char arrivalDate[16];
+    char arrivalTime[8];
+
+    format_date(passenger->flightDate, flightDate, sizeof(flightDate));
+    format_time(passenger->departureTime, departureTime, sizeof(departureTime));
+    format_date(passenger->arrivalDate, arrivalDate, sizeof(arrivalDate));
+    format_time(passenger->arrivalTime, arrivalTime, sizeof(arrivalTime));
+
+    fprintf(out, "/////////////GOLONDRINA VELOZ//////////////////////////////\n");
+    fprintf(out, "///////////////////////PASE DE ABORDAR/////////////////////\n");
+    fprintf(out, "Tipo vuelo: %s\n", FLIGHT_TYPE_LABELS[passenger->flightType]);
+    fprintf(out, "Código vuelo: %s\n", passenger->flightCode);
+    fprintf(out, "Documento pasajero: %s\n", passenger->document);
+    fprintf(out, "Nombre pasajero: %s\n", passenger->firstName);
+    fprintf(out, "Apellido pasajero: %s\n", passenger->lastName);
+    fprintf(out, "Clase de tiquete: %s\n", CLASS_LABELS[passenger->ticketClass]);
+    fprintf(out, "Fecha vuelo: %s\n", flightDate);
+    fprintf(out, "Hora salida: %s\n", departureTime);
+    fprintf(out, "Fecha llegada: %s\n", arrivalDate);
+    fprintf(out, "Hora llegada: %s\n", arrivalTime);
+    fprintf(out, "Silla: %d\n", passenger->seatNumber);
+}
+
 static void print_boarding_pass(Passenger *head) {
     char buffer[MAX_LINE_LENGTH];
     read_line("Documento del pasajero: ", buffer, sizeof(buffer));
@@ -556,30 +582,145 @@ static void print_boarding_pass(Passenger *head) {
         printf("No se encontró un pasajero con ese documento.\n");
         return;
     }
+    write_boarding_pass(stdout, passenger);
+}
 
-    char flightDate[16];
-    char departureTime[8];
-    char arrivalDate[16];
-    char arrivalTime[8];
+static bool same_date(Date a, Date b) {
+    return a.day == b.day && a.month == b.month && a.year == b.year;
+}
 
-    format_date(passenger->flightDate, flightDate, sizeof(flightDate));
-    format_time(passenger->departureTime, departureTime, sizeof(departureTime));
-    format_date(passenger->arrivalDate, arrivalDate, sizeof(arrivalDate));
-    format_time(passenger->arrivalTime, arrivalTime, sizeof(arrivalTime));
+static bool on_flight(const Passenger *passenger, FlightType flightType, Date flightDate) {
+    return passenger->flightType == flightType && same_date(passenger->flightDate, flightDate);
+}
 
-    printf("/////////////GOLONDRINA VELOZ//////////////////////////////\n");
-    printf("///////////////////////PASE DE ABORDAR/////////////////////\n");
-    printf("Tipo vuelo: %s\n", FLIGHT_TYPE_LABELS[passenger->flightType]);
-    printf("Código vuelo: %s\n", passenger->flightCode);
-    printf("Documento pasajero: %s\n", passenger->document);
-    printf("Nombre pasajero: %s\n", passenger->firstName);
-    printf("Apellido pasajero: %s\n", passenger->lastName);
-    printf("Clase de tiquete: %s\n", CLASS_LABELS[passenger->ticketClass]);
-    printf("Fecha vuelo: %s\n", flightDate);
-    printf("Hora salida: %s\n", departureTime);
-    printf("Fecha llegada: %s\n", arrivalDate);
-    printf("Hora llegada: %s\n", arrivalTime);
-    printf("Silla: %d\n", passenger->seatNumber);
+static int compare_by_seat(const void *a, const void *b) {
+    const Passenger *left = *(const Passenger *const *)a;
+    const Passenger *right = *(const Passenger *const *)b;
+    return left->seatNumber - right->seatNumber;
+}
+
+/* Documents are typed freely, so keep only characters that are safe in a file name.
+ * Distinct documents may map to the same tag; callers must not rely on it being unique. */
+static void sanitize_for_filename(const char *input, char *output, size_t size) {
+    size_t i = 0;
+    for (; input[i] != '\0' && i + 1 < size; ++i) {
+        unsigned char c = (unsigned char)input[i];
+        output[i] = (isalnum(c) || c == '-') ? (char)c : '_';
+    }
+    output[i] = '\0';
+}
+
+static FILE *open_output_file(const char *path, char *ioBuffer, size_t ioBufferSize) {
+    FILE *file = fopen(path, "w");
+    if (file) {
+        setvbuf(file, ioBuffer, _IOFBF, ioBufferSize);
+    }
+    return file;
+}
+
+static void generate_flight_passes(Passenger *head) {
+    FlightType flightType = read_flight_type();
+    Date flightDate;
+    char buffer[MAX_LINE_LENGTH];
+    while (1) {
+        read_line("Fecha del vuelo (dd/mm/aaaa): ", buffer, sizeof(buffer));
+        if (parse_date(buffer, &flightDate)) {
+            break;
+        }
+        printf("Fecha inválida.\n");
+    }
+
+    size_t count = 0;
+    for (Passenger *current = head; current; current = current->next) {
+        if (on_flight(current, flightType, flightDate)) {
+            count++;
+        }
+    }
+    if (count == 0) {
+        printf("No hay pasajeros registrados para ese vuelo.\n");
+        return;
+    }
+
+    Passenger **boarding = (Passenger **)malloc(count * sizeof(Passenger *));
+    if (!boarding) {
+        printf("No se pudo reservar memoria para generar los pases.\n");
+        return;
+    }
+    size_t index = 0;
+    for (Passenger *current = head; current; current = current->next) {
+        if (on_flight(current, flightType, flightDate)) {
+            boarding[index++] = current;
+        }
+    }
+    qsort(boarding, count, sizeof(Passenger *), compare_by_seat);
+
+    const char *flightCode = FLIGHT_CODES[flightType];
+    char dateTag[16];
+    snprintf(dateTag, sizeof(dateTag), "%04d%02d%02d", flightDate.year, flightDate.month, flightDate.day);
+
+    /* One full buffer per file: each pass and the manifest reach disk in a single write. */
+    static char ioBuffer[BUFSIZ * 4];
+    char path[MAX_LINE_LENGTH];
+    char manifestPath[MAX_LINE_LENGTH];
+    char documentTag[MAX_DOCUMENT_LENGTH];
+
+    snprintf(manifestPath, sizeof(manifestPath), "MANIFIESTO_%s_%s.txt", flightCode, dateTag);
+    FILE *manifest = open_output_file(manifestPath, ioBuffer, sizeof(ioBuffer));
+    if (!manifest) {
+        printf("No se pudo crear el archivo %s.\n", manifestPath);
+        free(boarding);
+        return;
+    }
+
+    char flightDateText[16];
+    format_date(flightDate, flightDateText, sizeof(flightDateText));
+    fprintf(manifest, "/////////////GOLONDRINA VELOZ//////////////////////////////\n");
+    fprintf(manifest, "///////////////////////MANIFIESTO//////////////////////////\n");
+    fprintf(manifest, "Código vuelo: %s\n", flightCode);
+    fprintf(manifest, "Fecha vuelo: %s\n", flightDateText);
+    fprintf(manifest, "Total pasajeros: %zu\n", count);
+    fprintf(manifest, "-----------------------------\n");
+    for (size_t i = 0; i < count; ++i) {
+        fprintf(manifest, "%3d | %-32s | %s %s | %s\n", boarding[i]->seatNumber, boarding[i]->document,
+                boarding[i]->firstName, boarding[i]->lastName, CLASS_LABELS[boarding[i]->ticketClass]);
+    }
+    bool manifestOk = !ferror(manifest);
+    if (fclose(manifest) != 0) {
+        manifestOk = false;
+    }
+    if (!manifestOk) {
+        printf("Error al escribir el manifiesto %s.\n", manifestPath);
+    }
+
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i) {
+        sanitize_for_filename(boarding[i]->document, documentTag, sizeof(documentTag));
+        /* The seat is unique within a flight, so it keeps file names apart even when tags collide. */
+        snprintf(path, sizeof(path), "PASE_%s_%s_%03d_%s.txt", flightCode, dateTag, boarding[i]->seatNumber,
+                 documentTag);
+        FILE *pass = open_output_file(path, ioBuffer, sizeof(ioBuffer));
+        if (!pass) {
+            printf("No se pudo crear el archivo %s.\n", path);
+            continue;
+        }
+        write_boarding_pass(pass, boarding[i]);
+        bool passOk = !ferror(pass);
+        if (fclose(pass) != 0) {
+            passOk = false;
+        }
+        if (passOk) {
+            written++;
+        } else {
+            printf("Error al escribir el pase %s.\n", path);
+        }
+    }
+    free(boarding);
+
+    if (manifestOk) {
+        printf("Pases generados: %zu de %zu. Manifiesto: %s\n", written, count, manifestPath);
+    } else {
+        printf("Pases generados: %zu de %zu. El manifiesto %s está incompleto.\n", written, count, manifestPath);
+    }
 }
 
 static void cancel_ticket(Passenger **head) {
@@ -624,7 +765,8 @@ static void print_menu(void) {
     printf("5. Cambiar Silla\n");
     printf("6. Imprimir pase de abordar\n");
     printf("7. Cancelar Tiquete\n");
-    printf("8. Salir\n");
+    printf("8. Generar pases de abordar del vuelo\n");
+    printf("9. Salir\n");
 }
 
 int main(void) {
@@ -659,6 +801,9 @@ int main(void) {
                 cancel_ticket(&head);
                 break;
             case 8:
+                generate_flight_passes(head);
+                break;
+            case 9:
                 free_passengers(head);
                 printf("Gracias por utilizar el sistema de tiquetes.\n");
                 return 0;